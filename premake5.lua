@@ -21,4 +21,7 @@ project "MyProject"
 
    filter "configurations:Distribution"
       defines { "NDEBUG" }
-      optimize "Full"
\ No newline at end of file
+      optimize "Full"
+
+   filter "system:linux"
+      links { "pthread" }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "stable_sort.h"
+#include "../container/vector.h"
+
+namespace eng
+{
+
+    namespace detail
+    {
+
+        // Lightweight sort record so merge passes move a key and index instead of the element itself
+        // Keys projected by lvalue reference are held by pointer, so the element is never copied
+        template<typename Projected, typename Index>
+        struct keyed_index
+        {
+            static constexpr bool INDIRECT = std::is_lvalue_reference_v<Projected>;
+
+            using Key = std::conditional_t<INDIRECT, const std::remove_reference_t<Projected>*, std::remove_cvref_t<Projected>>;
+
+            Key key;
+            Index index;
+
+            constexpr const auto& value() const noexcept
+            {
+                if constexpr (INDIRECT)
+                {
+                    return *key;
+                }
+                else
+                {
+                    return key;
+                }
+            }
+
+            constexpr bool operator<=(const keyed_index& other) const
+            {
+                return value() <= other.value();
+            }
+            constexpr bool operator>(const keyed_index& other) const
+            {
+                return value() > other.value();
+            }
+        };
+
+    }
+
+    // Returns the permutation that stably sorts [begin, end) by projected key; result[i] is the source index of the ith element
+    // Index may be narrowed to uint32_t to halve permutation traffic for ranges under 4G elements
+    template<typename Index = size_t, typename It, typename Projection = std::identity>
+    constexpr eng::vector<Index> stable_argsort(It begin, It end, Projection projection = { })
+    {
+        using Projected = std::invoke_result_t<Projection&, typename std::iterator_traits<It>::reference>;
+        using Record = detail::keyed_index<Projected, Index>;
+
+        static_assert(std::is_unsigned_v<Index>, "eng::stable_argsort<Index>() requires an unsigned Index");
+
+        size_t rangeSize = begin < end ? end - begin : 0;
+        if (rangeSize > std::numeric_limits<Index>::max())
+        {
+            throw std::length_error("eng::stable_argsort<Index>() range is too large for Index");
+        }
+
+        eng::vector<Record> records;
+        records.reserve(rangeSize);
+        for (size_t i = 0; i < rangeSize; ++i)
+        {
+            if constexpr (Record::INDIRECT)
+            {
+                records.push_back({ std::addressof(std::invoke(projection, *(begin + i))), static_cast<Index>(i) });
+            }
+            else
+            {
+                records.push_back({ std::invoke(projection, *(begin + i)), static_cast<Index>(i) });
+            }
+        }
+
+        eng::stable_sort(records.begin(), records.end());
+
+        eng::vector<Index> permutation(rangeSize);
+        for (size_t i = 0; i < rangeSize; ++i)
+        {
+            permutation[i] = records[i].index;
+        }
+        return permutation;
+    }
+
+    // Rearranges [begin, end) so that element i becomes the element previously at permutation[i]
+    // Follows each cycle once, so every element is moved exactly once plus one temporary per cycle
+    template<typename It, typename IndexIt>
+    constexpr void apply_permutation(It begin, It end, IndexIt permutation)
+    {
+        using Type = std::iterator_traits<It>::value_type;
+
+        // Bounds check and early exit
+        if (begin >= end)
+        {
+            return;
+        }
+
+        size_t rangeSize = end - begin;
+        bool* placed = new bool[rangeSize]{ };
+
+        for (size_t i = 0; i < rangeSize; ++i)
+        {
+            // Skip visited cycles and fixed points
+            if (placed[i] || static_cast<size_t>(*(permutation + i)) == i)
+            {
+                continue;
+            }
+
+            Type temp = std::move(*(begin + i));
+            size_t current = i; // current is always empty
+
+            for (size_t next = *(permutation + current); next != i; next = *(permutation + current))
+            {
+                *(begin + current) = std::move(*(begin + next));
+                placed[current] = true;
+                current = next; // Maintain that current is always empty
+            }
+
+            *(begin + current) = std::move(temp);   // Close cycle
+            placed[current] = true;
+        }
+
+        // Free heap-allocated buffers
+        delete[] placed;
+        placed = nullptr;
+    }
+
+    // Stably sorts [keyBegin, keyEnd) and applies the same reordering to each parallel range starting at others
+    template<typename Index = size_t, typename KeyIt, typename... OtherIts>
+    constexpr void stable_sort_parallel(KeyIt keyBegin, KeyIt keyEnd, OtherIts... others)
+    {
+        eng::vector<Index> permutation = eng::stable_argsort<Index>(keyBegin, keyEnd);
+
+        eng::apply_permutation(keyBegin, keyEnd, permutation.begin());
+        (eng::apply_permutation(others, others + (keyEnd - keyBegin), permutation.begin()), ...);
+    }
+
+}
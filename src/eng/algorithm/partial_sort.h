@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+
+#include "stable_sort.h"
+
+namespace eng
+{
+
+    namespace detail
+    {
+
+        // Orders indices by (value, original index); ties on value are broken by position for stability
+        template<typename It>
+        constexpr auto stable_index_order(It begin)
+        {
+            return [begin](size_t first, size_t second)
+            {
+                return *(begin + second) > *(begin + first) || (!(*(begin + first) > *(begin + second)) && first < second);
+            };
+        }
+
+        // Selects the count smallest elements as a max-heap of indices, matching the prefix a stable sort would produce
+        template<typename It>
+        constexpr size_t* select_stable(It begin, It end, size_t count)
+        {
+            auto precedes = stable_index_order(begin);
+
+            size_t rangeSize = end - begin;
+            size_t* heap = new size_t[count];
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                heap[i] = i;
+            }
+            std::make_heap(heap, heap + count, precedes);
+
+            // Later indices only displace the heap top if strictly smaller, keeping O(n log k)
+            for (size_t i = count; i < rangeSize; ++i)
+            {
+                if (*(begin + heap[0]) > *(begin + i))
+                {
+                    std::pop_heap(heap, heap + count, precedes);
+                    heap[count - 1] = i;
+                    std::push_heap(heap, heap + count, precedes);
+                }
+            }
+
+            return heap;
+        }
+
+        // Moves the elements at indices into [begin, begin + count) in the given order
+        // Displaced elements from the prefix fill the slots vacated beyond it
+        template<typename It>
+        constexpr void gather_front(It begin, const size_t* indices, size_t count)
+        {
+            using Type = std::iterator_traits<It>::value_type;
+
+            // Mark which prefix slots are already holding selected elements
+            bool* selected = new bool[count]{ };
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (indices[i] < count)
+                {
+                    selected[indices[i]] = true;
+                }
+            }
+
+            Type* buffer = new Type[count];
+            for (size_t i = 0; i < count; ++i)
+            {
+                buffer[i] = std::move(*(begin + indices[i]));
+            }
+
+            // Pair each vacated slot past the prefix with an unselected prefix element
+            size_t displaced = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (indices[i] < count)
+                {
+                    continue;
+                }
+
+                while (selected[displaced])
+                {
+                    ++displaced;
+                }
+                *(begin + indices[i]) = std::move(*(begin + displaced++));
+            }
+
+            std::move(buffer, buffer + count, begin);
+
+            // Free heap-allocated buffers
+            delete[] buffer;
+            delete[] selected;
+        }
+
+    }
+
+    // Places the (middle - begin) smallest elements in stable sorted order at the front; order of the rest is unspecified
+    template<typename It>
+    constexpr void stable_partial_sort(It begin, It middle, It end)
+    {
+        size_t count = middle - begin;
+
+        // Bounds check and early exit
+        if (begin >= end || !count)
+        {
+            return;
+        }
+
+        if (count >= static_cast<size_t>(end - begin))
+        {
+            eng::stable_sort(begin, end);
+            return;
+        }
+
+        size_t* indices = detail::select_stable(begin, end, count);
+
+        // Sorting the heap of indices orders them by (value, original index), so only k elements are sorted
+        std::sort_heap(indices, indices + count, detail::stable_index_order(begin));
+        detail::gather_front(begin, indices, count);
+
+        delete[] indices;
+    }
+
+    // Places the element a stable sort would put at nth there, preceded by all elements that would sort before it
+    // Elements before nth keep their original relative order; order of the rest is unspecified
+    template<typename It>
+    constexpr void stable_nth_element(It begin, It nth, It end)
+    {
+        // Bounds check and early exit
+        if (begin >= end || nth >= end)
+        {
+            return;
+        }
+
+        size_t count = nth - begin + 1;
+        size_t* indices = detail::select_stable(begin, end, count);
+
+        // Heap top is the nth element; the rest return to original order
+        std::swap(indices[0], indices[count - 1]);
+        std::sort(indices, indices + count - 1);
+        detail::gather_front(begin, indices, count);
+
+        delete[] indices;
+    }
+
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+
+#include "stable_sort.h"
+#include "../container/vector.h"
+
+namespace eng
+{
+
+    enum class unique_policy
+    {
+        keep_first,
+        keep_last
+    };
+
+    namespace detail
+    {
+
+        template<typename Type>
+        constexpr bool equivalent(const Type& first, const Type& second)
+        {
+            return !(first > second) && !(second > first);
+        }
+
+        // Compacts a sorted run in place, folding each group of equivalent elements with combiner in stable order
+        template<typename It, typename Combiner>
+        constexpr size_t unique_run(It begin, It end, Combiner& combiner)
+        {
+            if (begin == end)
+            {
+                return 0;
+            }
+
+            It kept = begin;
+            for (It scan = begin + 1; scan != end; ++scan)
+            {
+                if (equivalent(*kept, *scan))
+                {
+                    *kept = combiner(std::move(*kept), std::move(*scan));
+                    continue;
+                }
+
+                if (++kept != scan)
+                {
+                    *kept = std::move(*scan);
+                }
+            }
+            return kept - begin + 1;
+        }
+
+        // Merges two unique sorted runs into out, folding equivalent pairs so the output is unique too
+        template<typename InputIt, typename OutputIt, typename Combiner>
+        constexpr size_t merge_unique(InputIt firstBegin, InputIt firstEnd, InputIt secondBegin, InputIt secondEnd, OutputIt out, Combiner& combiner)
+        {
+            OutputIt outBegin = out;
+            while (firstBegin != firstEnd && secondBegin != secondEnd)
+            {
+                if (*firstBegin > *secondBegin)
+                {
+                    *out++ = std::move(*secondBegin++);
+                }
+                else if (*secondBegin > *firstBegin)
+                {
+                    *out++ = std::move(*firstBegin++);
+                }
+                else
+                {
+                    // Each run is already unique, so at most one element from each side is equivalent
+                    *out++ = combiner(std::move(*firstBegin++), std::move(*secondBegin++));
+                }
+            }
+
+            out = std::move(firstBegin, firstEnd, out); // Move rest of either run to output
+            out = std::move(secondBegin, secondEnd, out);
+            return out - outBegin;
+        }
+
+    }
+
+    // Stably sorts [begin, end) and folds each group of equivalent elements into one with combiner(kept, duplicate)
+    // Duplicates are dropped during each merge pass, so later passes only touch surviving elements
+    // Returns the new end; elements past it are left in a valid but unspecified state
+    template<typename InputIt, typename Combiner>
+    constexpr InputIt stable_sort_unique(InputIt begin, InputIt end, Combiner combiner)
+    {
+        using Type = std::iterator_traits<InputIt>::value_type;
+
+        // Bounds check and early exit
+        if (begin >= end || end - begin == 1)
+        {
+            return end;
+        }
+
+        size_t rangeSize = end - begin;
+
+        // Min-run optimization for more even merges
+        size_t min_run = rangeSize;
+        constexpr size_t MIN_RUN_THRESHOLD = 10;
+        while (min_run >= MIN_RUN_THRESHOLD)
+        {
+            min_run = (min_run + 1) / 2;
+        }
+
+        // Runs stay anchored at their original block offsets; lengths shrink as duplicates are folded
+        size_t runCount = (rangeSize + min_run - 1) / min_run;
+        size_t* runLengths = new size_t[runCount];
+        for (size_t i = 0; i < rangeSize; i += min_run)
+        {
+            InputIt runEnd = begin + std::min(i + min_run, rangeSize);
+            eng::insertion_sort(begin + i, runEnd);
+            runLengths[i / min_run] = detail::unique_run(begin + i, runEnd, combiner);
+        }
+
+        Type* buffer = runCount > 1 ? new Type[rangeSize] : nullptr;
+
+        for (size_t windowSize = min_run; windowSize < rangeSize; windowSize *= 2)
+        {
+            // Iterate through window sizes in pairs
+            for (size_t i = 0; i + windowSize < rangeSize; i += 2 * windowSize)
+            {
+                size_t mid = i + windowSize;
+                size_t& firstLength = runLengths[i / min_run];
+                size_t secondLength = runLengths[mid / min_run];
+
+                InputIt firstBegin = begin + i;
+                InputIt firstEnd = firstBegin + firstLength;
+                InputIt secondBegin = begin + mid;
+                InputIt secondEnd = secondBegin + secondLength;
+
+                // Already ordered runs only need closing the gap between them
+                if (*(firstEnd - 1) > *secondBegin)
+                {
+                    size_t mergedLength = detail::merge_unique(firstBegin, firstEnd, secondBegin, secondEnd, buffer, combiner);
+                    std::move(buffer, buffer + mergedLength, firstBegin);
+                    firstLength = mergedLength;
+                }
+                else if (*secondBegin > *(firstEnd - 1))
+                {
+                    if (firstEnd != secondBegin)    // Avoid self-move when no duplicates were dropped yet
+                    {
+                        std::move(secondBegin, secondEnd, firstEnd);
+                    }
+                    firstLength += secondLength;
+                }
+                else
+                {
+                    // Boundary elements are equivalent; fold them and close the gap
+                    *(firstEnd - 1) = combiner(std::move(*(firstEnd - 1)), std::move(*secondBegin));
+                    std::move(secondBegin + 1, secondEnd, firstEnd);
+                    firstLength += secondLength - 1;
+                }
+            }
+        }
+
+        size_t uniqueSize = runLengths[0];
+
+        // Free heap-allocated buffers
+        delete[] buffer;
+        delete[] runLengths;
+
+        return begin + uniqueSize;
+    }
+
+    template<typename InputIt>
+    constexpr InputIt stable_sort_unique(InputIt begin, InputIt end, unique_policy policy = unique_policy::keep_first)
+    {
+        using Type = std::iterator_traits<InputIt>::value_type;
+
+        if (policy == unique_policy::keep_last)
+        {
+            return eng::stable_sort_unique(begin, end, [](Type&&, Type&& duplicate) { return std::move(duplicate); });
+        }
+        return eng::stable_sort_unique(begin, end, [](Type&& kept, Type&&) { return std::move(kept); });
+    }
+
+    // Sorts and deduplicates the vector, then shrinks its size to the unique elements
+    template<typename Type, typename Allocator, typename Combiner>
+    constexpr void stable_sort_unique(vector<Type, Allocator>& values, Combiner combiner)
+    {
+        values.resize(eng::stable_sort_unique(values.begin(), values.end(), combiner) - values.begin());
+    }
+    template<typename Type, typename Allocator>
+    constexpr void stable_sort_unique(vector<Type, Allocator>& values, unique_policy policy = unique_policy::keep_first)
+    {
+        values.resize(eng::stable_sort_unique(values.begin(), values.end(), policy) - values.begin());
+    }
+
+}
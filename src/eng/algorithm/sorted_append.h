@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "stable_sort.h"
+
+namespace eng
+{
+
+    // Appends [begin, end) to an already sorted container, keeping it stably sorted in O(n + b log b)
+    // Only the batch is sorted; the container grows once and the batch is merged backwards from the tail,
+    // so scratch space is bounded by the batch size. Works with eng::vector and eng::mapped_vector.
+    // Batch elements are copy constructed into scratch once; pass std::move_iterator to move them instead.
+    template<typename Container, typename RandomIt>
+    constexpr void sorted_append(Container& sorted, RandomIt begin, RandomIt end)
+    {
+        using Type = Container::value_type;
+
+        // Bounds check and early exit
+        if (begin >= end)
+        {
+            return;
+        }
+
+        size_t oldSize = sorted.size();
+        size_t batchSize = end - begin;
+
+        // Sort batch separately in raw storage so elements are constructed from the batch, not default constructed then assigned
+        std::allocator<Type> allocator;
+        Type* buffer = allocator.allocate(batchSize);
+        if (std::is_constant_evaluated())   // Uninitialized-memory algorithms are not constexpr until C++26
+        {
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                std::construct_at(buffer + i, *(begin + i));
+            }
+        }
+        else
+        {
+            std::uninitialized_copy(begin, end, buffer);
+        }
+        eng::stable_sort(buffer, buffer + batchSize);
+
+        // Grow geometrically so repeated small batches do not reallocate every time
+        size_t newSize = oldSize + batchSize;
+        if (sorted.capacity() < newSize)
+        {
+            sorted.reserve(std::max(newSize, sorted.capacity() + sorted.capacity() / 2));
+        }
+        sorted.resize(newSize);
+
+        // Batch elements compare after equal existing elements, matching a stable sort of the concatenation
+        eng::merge_backward(sorted.begin(), sorted.begin() + oldSize, buffer, buffer + batchSize, sorted.begin() + newSize);
+
+        // Free heap-allocated buffers
+        std::destroy_n(buffer, batchSize);
+        allocator.deallocate(buffer, batchSize);
+        buffer = nullptr;
+    }
+
+}
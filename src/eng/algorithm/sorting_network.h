@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace eng
+{
+
+    namespace detail
+    {
+
+        // Visits the comparators of Batcher's odd-even merge sort pruned to count inputs
+        template<typename Visitor>
+        constexpr void visit_odd_even_network(size_t count, Visitor visit)
+        {
+            for (size_t p = 1; p < count; p *= 2)
+            {
+                for (size_t k = p; k >= 1; k /= 2)
+                {
+                    for (size_t j = k % p; j + k < count; j += 2 * k)
+                    {
+                        for (size_t i = 0; i < k && i + j + k < count; ++i)
+                        {
+                            // Only compare elements within the same merge block of size 2p
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                            {
+                                visit(i + j, i + j + k);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        template<size_t Count>
+        constexpr size_t network_size()
+        {
+            size_t comparators = 0;
+            visit_odd_even_network(Count, [&comparators](size_t, size_t) { ++comparators; });
+            return comparators;
+        }
+
+        // Comparator list is computed entirely at compile time
+        template<size_t Count>
+        constexpr auto make_network()
+        {
+            std::array<std::pair<size_t, size_t>, network_size<Count>()> network{ };
+            size_t comparator = 0;
+            visit_odd_even_network(Count, [&](size_t first, size_t second) { network[comparator++] = { first, second }; });
+            return network;
+        }
+
+        template<size_t Count>
+        inline constexpr auto SORTING_NETWORK = make_network<Count>();
+
+        template<typename It>
+        constexpr void compare_exchange(It first, It second)
+        {
+            using Type = std::iterator_traits<It>::value_type;
+
+            if constexpr (std::is_floating_point_v<Type>)
+            {
+                // min/max map to minss/maxss; a select on > still compiles to a branch for floating point
+                Type low = *first;
+                Type high = *second;
+                *first = std::min(low, high);
+                *second = std::max(low, high);
+            }
+            else if constexpr (std::is_trivially_copyable_v<Type>)
+            {
+                // Select both outputs unconditionally so the compiler can emit conditional moves instead of branches
+                Type low = *first;
+                Type high = *second;
+                bool swapped = low > high;
+                *first = swapped ? high : low;
+                *second = swapped ? low : high;
+            }
+            else if (*first > *second)
+            {
+                std::swap(*first, *second);
+            }
+        }
+
+        template<size_t Count, typename It, size_t... Comparators>
+        constexpr void apply_network(It begin, std::index_sequence<Comparators...>)
+        {
+            // Fold expands every comparator inline; no loop or index bookkeeping survives at runtime
+            (compare_exchange(begin + SORTING_NETWORK<Count>[Comparators].first, begin + SORTING_NETWORK<Count>[Comparators].second), ...);
+        }
+
+    }
+
+    // Sorts exactly Count elements starting at begin with a fixed sorting network; not stable
+    // Networks are Batcher's odd-even merge sort pruned to Count. They are size-optimal for Count <= 8; for Count 9-16
+    // they use 28/32/38/42/48/53/59/63 comparators against the best known 25/29/35/39/45/51/56/60
+    template<size_t Count, typename It>
+    constexpr void sort_n(It begin)
+    {
+        if constexpr (Count > 1)
+        {
+            detail::apply_network<Count>(begin, std::make_index_sequence<detail::SORTING_NETWORK<Count>.size()>{ });
+        }
+    }
+
+}
@@ -6,7 +6,7 @@ namespace eng
 {
 
     template<typename It>
-    void reverse(It begin, It end)
+    constexpr void reverse(It begin, It end)
     {
         --end;
         while (begin < end)
@@ -16,13 +16,13 @@ namespace eng
     }
 
     template<typename It>
-    void reverse_strictly_decreasing(It begin, It end, size_t tolerance = 1)    // tolerance 1 for strict ordering
+    constexpr void reverse_strictly_decreasing(It begin, It end, size_t tolerance = 1)    // tolerance 1 for strict ordering
     {
         auto runBegin = begin;
         for (auto runEnd = begin + 1; runBegin != end; ++runEnd)
         {
             // Check for ascending runs and bounds check
-            if (*(runEnd - 1) > *runEnd && runEnd != end)
+            if (runEnd != end && *(runEnd - 1) > *runEnd)
             {
                 continue;
             }
@@ -30,14 +30,14 @@ namespace eng
             // Tolerance specifies what reversals are worth the cost
             if (static_cast<size_t>(runEnd - runBegin) > tolerance)
             {
-                reverse(runBegin, runEnd);
+                eng::reverse(runBegin, runEnd);
             }
             runBegin = runEnd;  // Reset run start; equivalent elements are within tolerance of 1
         }
     }
 
     template<typename It>
-    void insertion_sort(It begin, It end)
+    constexpr void insertion_sort(It begin, It end)
     {
         using Type = std::iterator_traits<It>::value_type;
 
@@ -72,7 +72,7 @@ namespace eng
     }
 
     template<typename InputIt, typename OutputIt>
-    void merge(InputIt firstBegin, InputIt firstEnd, InputIt secondBegin, InputIt secondEnd, OutputIt out)
+    constexpr void merge(InputIt firstBegin, InputIt firstEnd, InputIt secondBegin, InputIt secondEnd, OutputIt out)
     {
         while (firstBegin != firstEnd)
         {
@@ -89,8 +89,26 @@ namespace eng
         std::move(secondBegin, secondEnd, out); // Move rest of second run to buffer
     }
 
+    // Merges from the back into [.., outEnd) where the first run already sits at the front of the output
+    // Stops once the second run is exhausted since the rest of the first run is then in place
+    template<typename FirstIt, typename SecondIt, typename OutputIt>
+    constexpr void merge_backward(FirstIt firstBegin, FirstIt firstEnd, SecondIt secondBegin, SecondIt secondEnd, OutputIt outEnd)
+    {
+        while (secondBegin != secondEnd)
+        {
+            if (firstBegin == firstEnd)
+            {
+                std::move_backward(secondBegin, secondEnd, outEnd); // Move rest of second run to output
+                return;
+            }
+
+            // Select element from the back with strict ordering in favor of first run at the front
+            *--outEnd = std::move(*(firstEnd - 1) > *(secondEnd - 1) ? *--firstEnd : *--secondEnd);
+        }
+    }
+
     template<typename InputIt>
-    void stable_sort(InputIt begin, InputIt end)
+    constexpr void stable_sort(InputIt begin, InputIt end)
     {
         using Type = std::iterator_traits<InputIt>::value_type;
 
@@ -111,10 +129,10 @@ namespace eng
         }
 
         constexpr size_t REVERSAL_TOLERANCE = 2;    // Tolerance specifies meaningful reversals
-        reverse_strictly_decreasing(begin, end, REVERSAL_TOLERANCE);    // Reduce worst-case for insertion sort
+        eng::reverse_strictly_decreasing(begin, end, REVERSAL_TOLERANCE);    // Reduce worst-case for insertion sort
         for (size_t i = 0; i < rangeSize; i += min_run) // Use insertion sort for small runs
         {
-            insertion_sort(begin + i, begin + std::min(i + min_run, rangeSize));
+            eng::insertion_sort(begin + i, begin + std::min(i + min_run, rangeSize));
         }
 
         // Array was small enough to sort with insertion sort
@@ -142,7 +160,7 @@ namespace eng
                 }
 
                 // Merge to buffer
-                merge(begin + i, begin + mid, begin + mid, begin + back, buffer);
+                eng::merge(begin + i, begin + mid, begin + mid, begin + back, buffer);
 
                 // Marking next adjacent runs
                 size_t j = i + 2 * windowSize;
@@ -160,10 +178,10 @@ namespace eng
                 back = std::min(j + 2 * windowSize, rangeSize);
 
                 // Merge next adjacent runs to buffer
-                merge(begin + j, begin + mid, begin + mid, begin + back, buffer + (2 * windowSize));
+                eng::merge(begin + j, begin + mid, begin + mid, begin + back, buffer + (2 * windowSize));
 
                 // Merge runs in buffer back to main
-                merge(buffer, buffer + 2 * windowSize, buffer + 2 * windowSize, buffer + (back - i), begin + i);
+                eng::merge(buffer, buffer + 2 * windowSize, buffer + 2 * windowSize, buffer + (back - i), begin + i);
                 
                 // Advance i to skip merged runs
                 i = j;
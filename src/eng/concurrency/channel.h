@@ -0,0 +1,191 @@
+#pragma once
+
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+#include "thread_pool.h"
+
+namespace eng
+{
+
+    // Bounded multi-producer multi-consumer queue; full pushes and empty pops suspend instead of blocking a thread
+    // Suspended coroutines are resumed on the pool once space or data is available
+    template<typename Type>
+    struct channel
+    {
+        channel(thread_pool& pool, size_t capacity, size_t producers = 1) :
+            mPool(pool),
+            mCapacity(capacity ? capacity : 1),
+            mProducers(producers),
+            mClosed(false)
+        { }
+
+        channel(const channel&) = delete;
+        channel& operator=(const channel&) = delete;
+
+        struct push_awaiter
+        {
+            channel& queue;
+            Type value;
+            std::coroutine_handle<> handle;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+            bool await_suspend(std::coroutine_handle<> awaiting)
+            {
+                std::unique_lock lock{ queue.mMutex };
+                if (queue.offer(value, lock))
+                {
+                    return false;
+                }
+
+                handle = awaiting;
+                queue.mPushers.push_back(this);
+                return true;
+            }
+            void await_resume() const noexcept
+            { }
+        };
+
+        struct pop_awaiter
+        {
+            channel& queue;
+            std::optional<Type> result;
+            std::coroutine_handle<> handle;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+            bool await_suspend(std::coroutine_handle<> awaiting)
+            {
+                std::unique_lock lock{ queue.mMutex };
+                if (!queue.mItems.empty())
+                {
+                    result.emplace(std::move(queue.mItems.front()));
+                    queue.mItems.pop_front();
+
+                    // Space freed; admit one waiting pusher
+                    if (!queue.mPushers.empty())
+                    {
+                        push_awaiter* pusher = queue.mPushers.front();
+                        queue.mPushers.pop_front();
+                        queue.mItems.push_back(std::move(pusher->value));
+                        lock.unlock();
+                        queue.mPool.post(pusher->handle);
+                    }
+                    return false;
+                }
+
+                if (queue.mClosed)
+                {
+                    return false;   // Closed and drained; result stays empty
+                }
+
+                handle = awaiting;
+                queue.mPoppers.push_back(this);
+                return true;
+            }
+            std::optional<Type> await_resume()
+            {
+                return std::move(result);
+            }
+        };
+
+        // co_await queue.push(value) suspends while the queue is full
+        push_awaiter push(Type value)
+        {
+            return push_awaiter{ *this, std::move(value), { } };
+        }
+        // co_await queue.pop() yields an empty optional once the queue is closed and drained
+        pop_awaiter pop()
+        {
+            return pop_awaiter{ *this, std::nullopt, { } };
+        }
+
+        // Non-suspending push for callers that know the queue has room, e.g. returning recycled buffers
+        bool try_push(Type value)
+        {
+            std::unique_lock lock{ mMutex };
+            return offer(value, lock);
+        }
+
+        // Called once by each producer; the queue closes after the last one
+        void close()
+        {
+            std::unique_lock lock{ mMutex };
+            if (mProducers && --mProducers)
+            {
+                return;
+            }
+            wake_all(lock);
+        }
+        // Closes immediately and discards queued items, waking every waiter; used to unwind a pipeline after a failure
+        void abort()
+        {
+            std::unique_lock lock{ mMutex };
+            mProducers = 0;
+            mItems.clear(); // Pops see a closed, empty queue, so no stage consumes work queued before the failure
+            wake_all(lock);
+        }
+
+    private:
+        // Hands value to a waiting popper or enqueues it if there is room; unlocks before resuming anyone
+        bool offer(Type& value, std::unique_lock<std::mutex>& lock)
+        {
+            if (mClosed)
+            {
+                return true;    // Drop values pushed after close
+            }
+
+            if (!mPoppers.empty())
+            {
+                pop_awaiter* popper = mPoppers.front();
+                mPoppers.pop_front();
+                popper->result.emplace(std::move(value));
+                lock.unlock();
+                mPool.post(popper->handle);
+                return true;
+            }
+
+            if (mItems.size() < mCapacity)
+            {
+                mItems.push_back(std::move(value));
+                return true;
+            }
+            return false;
+        }
+        void wake_all(std::unique_lock<std::mutex>& lock)
+        {
+            mClosed = true;
+            std::deque<pop_awaiter*> poppers = std::move(mPoppers);
+            std::deque<push_awaiter*> pushers = std::move(mPushers);
+            mPoppers.clear();
+            mPushers.clear();
+            lock.unlock();
+
+            for (pop_awaiter* popper : poppers)
+            {
+                mPool.post(popper->handle);
+            }
+            for (push_awaiter* pusher : pushers)
+            {
+                mPool.post(pusher->handle);
+            }
+        }
+
+        thread_pool& mPool;
+        std::mutex mMutex;
+        std::deque<Type> mItems;
+        std::deque<pop_awaiter*> mPoppers;
+        std::deque<push_awaiter*> mPushers;
+        size_t mCapacity;
+        size_t mProducers;
+        bool mClosed;
+    };
+
+}
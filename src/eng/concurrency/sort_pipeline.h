@@ -0,0 +1,169 @@
+#pragma once
+
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "channel.h"
+#include "task.h"
+#include "thread_pool.h"
+#include "../algorithm/stable_sort.h"
+#include "../container/vector.h"
+
+namespace eng
+{
+
+    struct pipeline_options
+    {
+        size_t threads = 0;         // 0 picks the hardware concurrency
+        size_t buffers = 4;         // Chunk buffers in flight; recycled, never reallocated once warm
+        size_t chunkSize = 0;       // Capacity reserved up front in each buffer
+        size_t sortWorkers = 2;     // Concurrent sort stages
+        size_t queueCapacity = 2;   // Chunks queued between stages
+        bool mergePairs = true;     // Merge pairs of sorted chunks into runs twice as long before the sink
+    };
+
+    namespace detail
+    {
+
+        template<typename Type>
+        using chunk_channel = channel<vector<Type>>;
+
+        // Fills recycled buffers with reader(chunk) until it returns false
+        template<typename Type, typename Reader>
+        task source_stage(chunk_channel<Type>& freeBuffers, chunk_channel<Type>& out, Reader& reader)
+        {
+            for (bool more = true; more; )
+            {
+                std::optional<vector<Type>> chunk = co_await freeBuffers.pop();
+                if (!chunk)
+                {
+                    break;  // Pipeline aborted
+                }
+
+                chunk->clear();
+                more = reader(*chunk);
+
+                if (chunk->empty())
+                {
+                    freeBuffers.try_push(std::move(*chunk));
+                    continue;
+                }
+                co_await out.push(std::move(*chunk));
+            }
+            out.close();
+        }
+
+        template<typename Type>
+        task sort_stage(chunk_channel<Type>& in, chunk_channel<Type>& out)
+        {
+            while (std::optional<vector<Type>> chunk = co_await in.pop())
+            {
+                eng::stable_sort(chunk->begin(), chunk->end());
+                co_await out.push(std::move(*chunk));
+            }
+            out.close();
+        }
+
+        // Merges pairs of sorted chunks through a stage-owned scratch buffer so no buffer is taken from the free pool
+        template<typename Type>
+        task merge_stage(chunk_channel<Type>& in, chunk_channel<Type>& freeBuffers, chunk_channel<Type>& out)
+        {
+            vector<Type> scratch;
+            while (std::optional<vector<Type>> first = co_await in.pop())
+            {
+                std::optional<vector<Type>> second = co_await in.pop();
+                if (!second)
+                {
+                    co_await out.push(std::move(*first));   // Odd chunk out passes through unmerged
+                    break;
+                }
+
+                scratch.clear();
+                scratch.reserve(first->size() + second->size());
+                eng::merge(first->begin(), first->end(), second->begin(), second->end(), std::back_inserter(scratch));
+
+                // Merged run takes over the first buffer; its old storage becomes the next scratch
+                first->swap(scratch);
+                second->clear();
+                freeBuffers.try_push(std::move(*second));
+                co_await out.push(std::move(*first));
+            }
+            out.close();
+        }
+
+        // Hands sorted runs to writer(run) and returns their buffers to the free pool
+        template<typename Type, typename Writer>
+        task sink_stage(chunk_channel<Type>& in, chunk_channel<Type>& freeBuffers, Writer& writer)
+        {
+            while (std::optional<vector<Type>> run = co_await in.pop())
+            {
+                writer(std::as_const(*run));
+                run->clear();
+                freeBuffers.try_push(std::move(*run));
+            }
+        }
+
+    }
+
+    // Reads chunks with reader(eng::vector<Type>&) -> bool, sorts them with eng::stable_sort and writes sorted runs
+    // with writer(const eng::vector<Type>&). Stages run concurrently on a thread pool, so I/O overlaps sorting.
+    // Runs reach the writer in completion order. Reader and writer may block; size threads to leave room for sorting.
+    template<typename Type, typename Reader, typename Writer>
+    void sort_pipeline(Reader reader, Writer writer, const pipeline_options& options = { })
+    {
+        // Merge stage holds one run while awaiting its partner, so a second buffer must be able to reach it
+        if (options.buffers < 2)
+        {
+            throw std::invalid_argument("eng::sort_pipeline() requires at least 2 buffers");
+        }
+
+        size_t sortWorkers = options.sortWorkers ? options.sortWorkers : 1;
+
+        thread_pool pool{ options.threads };
+
+        // Free pool holds every buffer, so returning one never suspends
+        detail::chunk_channel<Type> freeBuffers{ pool, options.buffers };
+        detail::chunk_channel<Type> unsorted{ pool, options.queueCapacity };
+        detail::chunk_channel<Type> sorted{ pool, options.queueCapacity, sortWorkers };
+        detail::chunk_channel<Type> merged{ pool, options.queueCapacity };
+
+        for (size_t i = 0; i < options.buffers; ++i)
+        {
+            vector<Type> buffer;
+            buffer.reserve(options.chunkSize);
+            freeBuffers.try_push(std::move(buffer));
+        }
+
+        size_t stageCount = sortWorkers + (options.mergePairs ? 3 : 2);
+        task_group group{ static_cast<ptrdiff_t>(stageCount) };
+        group.cancel = [&]
+        {
+            freeBuffers.abort();
+            unsorted.abort();
+            sorted.abort();
+            merged.abort();
+        };
+
+        vector<task> stages;
+        stages.reserve(stageCount);
+        stages.push_back(detail::source_stage<Type>(freeBuffers, unsorted, reader));
+        for (size_t i = 0; i < sortWorkers; ++i)
+        {
+            stages.push_back(detail::sort_stage<Type>(unsorted, sorted));
+        }
+        if (options.mergePairs)
+        {
+            stages.push_back(detail::merge_stage<Type>(sorted, freeBuffers, merged));
+        }
+        stages.push_back(detail::sink_stage<Type>(options.mergePairs ? merged : sorted, freeBuffers, writer));
+
+        for (auto& stage : stages)
+        {
+            stage.start(pool, group);
+        }
+        group.wait();
+    }
+
+}
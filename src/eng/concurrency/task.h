@@ -0,0 +1,135 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <utility>
+
+#include "thread_pool.h"
+
+namespace eng
+{
+
+    // Tracks completion of a fixed number of tasks and keeps the first failure
+    struct task_group
+    {
+        explicit task_group(ptrdiff_t count) :
+            mDone(count)
+        { }
+
+        // Invoked once on the first failure so the remaining tasks can unwind instead of waiting forever
+        std::function<void()> cancel;
+
+        void finish() noexcept
+        {
+            mDone.count_down();
+        }
+        void fail(std::exception_ptr error) noexcept
+        {
+            {
+                std::lock_guard lock{ mMutex };
+                if (mError)
+                {
+                    return;
+                }
+                mError = error;
+            }
+
+            if (cancel)
+            {
+                cancel();
+            }
+        }
+
+        // Blocks until every task finished, then rethrows the first failure
+        void wait()
+        {
+            mDone.wait();
+            if (mError)
+            {
+                std::rethrow_exception(mError);
+            }
+        }
+
+    private:
+        std::latch mDone;
+        std::mutex mMutex;
+        std::exception_ptr mError;
+    };
+
+    // Lazily started coroutine that runs on a thread_pool and reports to a task_group when done
+    struct task
+    {
+        struct promise_type
+        {
+            task_group* group = nullptr;
+
+            task get_return_object() noexcept
+            {
+                return task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return { };
+            }
+            auto final_suspend() const noexcept
+            {
+                // Stay suspended so the owner destroys the frame after task_group::wait() returns
+                struct awaiter
+                {
+                    bool await_ready() const noexcept
+                    {
+                        return false;
+                    }
+                    void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                    {
+                        handle.promise().group->finish();
+                    }
+                    void await_resume() const noexcept
+                    { }
+                };
+                return awaiter{ };
+            }
+            void return_void() const noexcept
+            { }
+            void unhandled_exception() const noexcept
+            {
+                group->fail(std::current_exception());
+            }
+        };
+
+        task(task&& other) noexcept :
+            mHandle(std::exchange(other.mHandle, nullptr))
+        { }
+        task& operator=(task&& other) noexcept
+        {
+            std::swap(mHandle, other.mHandle);
+            return *this;
+        }
+
+        ~task()
+        {
+            if (mHandle)
+            {
+                mHandle.destroy();
+            }
+        }
+
+        void start(thread_pool& pool, task_group& group)
+        {
+            mHandle.promise().group = &group;
+            pool.post(mHandle);
+        }
+
+    private:
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept :
+            mHandle(handle)
+        { }
+
+        std::coroutine_handle<promise_type> mHandle;
+    };
+
+}
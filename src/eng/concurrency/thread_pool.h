@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "../container/vector.h"
+
+namespace eng
+{
+
+    // Fixed set of worker threads that resume suspended coroutines in FIFO order
+    struct thread_pool
+    {
+        explicit thread_pool(size_t threadCount = 0) :
+            mStopping(false)
+        {
+            // 0 picks the hardware concurrency; unknown hardware still gets a worker
+            if (!threadCount)
+            {
+                threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            }
+
+            mThreads.reserve(threadCount);
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                mThreads.emplace_back([this] { work(); });
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool()
+        {
+            {
+                std::lock_guard lock{ mMutex };
+                mStopping = true;
+            }
+            mCondition.notify_all();
+
+            for (auto& thread : mThreads)
+            {
+                thread.join();
+            }
+        }
+
+        void post(std::coroutine_handle<> handle)
+        {
+            {
+                std::lock_guard lock{ mMutex };
+                mQueue.push_back(handle);
+            }
+            mCondition.notify_one();
+        }
+
+        // co_await pool.schedule() continues the awaiting coroutine on a worker thread
+        auto schedule() noexcept
+        {
+            struct awaiter
+            {
+                thread_pool& pool;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    pool.post(handle);
+                }
+                void await_resume() const noexcept
+                { }
+            };
+            return awaiter{ *this };
+        }
+
+        size_t size() const noexcept
+        {
+            return mThreads.size();
+        }
+
+    private:
+        void work()
+        {
+            while (true)
+            {
+                std::coroutine_handle<> handle;
+                {
+                    std::unique_lock lock{ mMutex };
+                    mCondition.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+
+                    // Drain remaining work before stopping
+                    if (mQueue.empty())
+                    {
+                        return;
+                    }
+
+                    handle = mQueue.front();
+                    mQueue.pop_front();
+                }
+                handle.resume();
+            }
+        }
+
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::deque<std::coroutine_handle<>> mQueue;
+        eng::vector<std::thread> mThreads;
+        bool mStopping;
+    };
+
+}
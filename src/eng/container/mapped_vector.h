@@ -0,0 +1,425 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../algorithm/stable_sort.h"
+
+namespace eng
+{
+
+    enum class map_mode
+    {
+        read_only,
+        read_write
+    };
+
+    // File-backed vector of trivially copyable elements; opening is a single mmap with no parsing or copying.
+    // POSIX only. File layout is a fixed 64-byte header followed directly by the elements.
+    template<typename Type>
+    struct mapped_vector
+    {
+        static_assert(std::is_trivially_copyable_v<Type>, "eng::mapped_vector<Type> requires a trivially copyable Type");
+
+        using value_type = Type;
+        using size_type = size_t;
+
+        using iterator = value_type*;
+        using const_iterator = value_type const*;
+
+        static constexpr uint64_t MAGIC = 0x524556504d474e45;  // "ENGMPVER" little-endian
+        static constexpr uint32_t VERSION = 1;
+
+        struct alignas(64) header  // Cache-line sized so element data stays aligned
+        {
+            uint64_t magic;
+            uint32_t version;
+            uint32_t elementSize;
+            uint64_t count;
+            uint64_t checksum;
+        };
+
+    private:
+        static_assert(alignof(Type) <= alignof(header), "eng::mapped_vector<Type> cannot satisfy the alignment of Type");
+
+        static constexpr double GROWTH_FACTOR = 1.5;
+        static constexpr size_type DEFAULT_SIZE = 4;
+
+    public:
+        mapped_vector(const char* path, map_mode mode = map_mode::read_only) :
+            mMode(mode),
+            mFile(-1),
+            mCapacity(0),
+            mHeader(nullptr),
+            mDirty(false)
+        {
+            bool writable = mode == map_mode::read_write;
+            mFile = ::open(path, writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+            if (mFile < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "eng::mapped_vector<Type> failed to open file");
+            }
+
+            struct stat status;
+            if (::fstat(mFile, &status) < 0)
+            {
+                close_file();
+                throw std::system_error(errno, std::generic_category(), "eng::mapped_vector<Type> failed to stat file");
+            }
+            size_type fileSize = static_cast<size_type>(status.st_size);
+
+            // Initialize header for new files
+            if (!fileSize && writable)
+            {
+                header empty{ MAGIC, VERSION, sizeof(value_type), 0, checksum(nullptr, 0) };
+                if (::ftruncate(mFile, sizeof(header)) < 0 || ::pwrite(mFile, &empty, sizeof(header), 0) != sizeof(header))
+                {
+                    int error = errno;
+                    close_file();
+                    throw std::system_error(error, std::generic_category(), "eng::mapped_vector<Type> failed to initialize file");
+                }
+                fileSize = sizeof(header);
+            }
+
+            if (fileSize < sizeof(header))
+            {
+                close_file();
+                throw std::runtime_error("eng::mapped_vector<Type> file is too small to hold a header");
+            }
+
+            mCapacity = (fileSize - sizeof(header)) / sizeof(value_type);
+            map();
+
+            // Validate header in O(1); full checksum verification is left to verify()
+            if (mHeader->magic != MAGIC || mHeader->version != VERSION || mHeader->elementSize != sizeof(value_type) || mHeader->count > mCapacity)
+            {
+                unmap();
+                close_file();
+                throw std::runtime_error("eng::mapped_vector<Type> file header does not match Type");
+            }
+        }
+
+        mapped_vector(const mapped_vector&) = delete;
+        mapped_vector(mapped_vector&& other) noexcept :
+            mMode(other.mMode),
+            mFile(std::exchange(other.mFile, -1)),
+            mCapacity(std::exchange(other.mCapacity, 0)),
+            mHeader(std::exchange(other.mHeader, nullptr)),
+            mDirty(std::exchange(other.mDirty, false))
+        { }
+
+        mapped_vector& operator=(const mapped_vector&) = delete;
+        mapped_vector& operator=(mapped_vector&& other) noexcept
+        {
+            using std::swap;
+            swap(mMode, other.mMode);
+            swap(mFile, other.mFile);
+            swap(mCapacity, other.mCapacity);
+            swap(mHeader, other.mHeader);
+            swap(mDirty, other.mDirty);
+            return *this;
+        }
+
+        ~mapped_vector()
+        {
+            // Unmodified mappings skip the O(n) checksum pass
+            if (mHeader && writable() && mDirty)
+            {
+                mHeader->checksum = checksum(elements(), size());
+            }
+            unmap();
+            close_file();
+        }
+
+        value_type& push_back(value_type value)    // By value; remapping may move the element value referred to
+        {
+            require_writable("push_back");
+            if (size() >= mCapacity)
+            {
+                remap(std::max<size_type>(size() + 1, size() ? size() * GROWTH_FACTOR : DEFAULT_SIZE));   // Small sizes truncate to no growth
+            }
+
+            mDirty = true;
+            elements()[mHeader->count] = value;
+            return elements()[mHeader->count++];
+        }
+        void pop_back()
+        {
+            require_writable("pop_back");
+            if (empty())
+            {
+                throw std::out_of_range("eng::mapped_vector<Type>::pop_back() was called on an empty container");
+            }
+            mDirty = true;
+            --mHeader->count;
+        }
+
+        void clear()
+        {
+            require_writable("clear");
+            mDirty = true;
+            mHeader->count = 0;
+        }
+        void reserve(size_type newCapacity)
+        {
+            require_writable("reserve");
+            if (mCapacity < newCapacity)
+            {
+                remap(newCapacity);
+            }
+        }
+        void resize(size_type newSize)
+        {
+            reserve(newSize);
+            mDirty = true;
+            if (newSize > size())
+            {
+                std::memset(static_cast<void*>(elements() + size()), 0, (newSize - size()) * sizeof(value_type));
+            }
+            mHeader->count = newSize;
+        }
+        void shrink_to_fit()
+        {
+            require_writable("shrink_to_fit");
+            if (size() < mCapacity)
+            {
+                remap(size());
+            }
+        }
+
+        // Sorts the persisted elements in place and records the new checksum
+        void sort()
+        {
+            require_writable("sort");
+            eng::stable_sort(elements(), elements() + size());
+            mDirty = true;
+            sync();
+        }
+
+        // Writes the checksum if anything changed and flushes dirty pages to the file
+        void sync()
+        {
+            require_writable("sync");
+            if (mDirty)
+            {
+                mHeader->checksum = checksum(elements(), size());
+                mDirty = false;
+            }
+            if (::msync(mHeader, mapped_length(), MS_SYNC) < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "eng::mapped_vector<Type>::sync() failed to flush mapping");
+            }
+        }
+        // Checks stored checksum against contents; O(n), so not done on open
+        bool verify() const noexcept
+        {
+            return mHeader->checksum == checksum(elements(), size());
+        }
+
+        // Mutable access marks the mapping dirty so the checksum is refreshed on sync() or close
+        // Writes through references or pointers kept across sync() are not covered
+        value_type& operator[](size_type index)
+        {
+            mDirty = true;
+            return elements()[index];
+        }
+        const value_type& operator[](size_type index) const
+        {
+            return elements()[index];
+        }
+
+        value_type& at(size_type index)
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("mapped_vector::at(size_type) tried to access an element out of bounds");
+            }
+            mDirty = true;
+            return elements()[index];
+        }
+        const value_type& at(size_type index) const
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("mapped_vector::at(size_type) tried to access an element out of bounds");
+            }
+            return elements()[index];
+        }
+
+        bool empty() const noexcept
+        {
+            return !size();
+        }
+        size_type size() const noexcept
+        {
+            return mHeader->count;
+        }
+        size_type capacity() const noexcept
+        {
+            return mCapacity;
+        }
+        bool writable() const noexcept
+        {
+            return mMode == map_mode::read_write;
+        }
+        value_type* data() noexcept
+        {
+            mDirty = true;
+            return elements();
+        }
+        const value_type* data() const noexcept
+        {
+            return elements();
+        }
+
+        value_type& front()
+        {
+            mDirty = true;
+            return elements()[0];
+        }
+        const value_type& front() const
+        {
+            return elements()[0];
+        }
+        value_type& back()
+        {
+            mDirty = true;
+            return elements()[size() - 1];
+        }
+        const value_type& back() const
+        {
+            return elements()[size() - 1];
+        }
+
+        iterator begin() noexcept
+        {
+            mDirty = true;
+            return elements();
+        }
+        iterator end() noexcept
+        {
+            mDirty = true;
+            return elements() + size();
+        }
+        const_iterator begin() const noexcept
+        {
+            return elements();
+        }
+        const_iterator end() const noexcept
+        {
+            return elements() + size();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return elements();
+        }
+        const_iterator cend() const noexcept
+        {
+            return elements() + size();
+        }
+
+    protected:
+        // 64-bit FNV-1a over the element bytes
+        static uint64_t checksum(const value_type* elements, size_type count) noexcept
+        {
+            uint64_t hash = 0xcbf29ce484222325;
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(elements);
+            for (size_type i = 0; i < count * sizeof(value_type); ++i)
+            {
+                hash = (hash ^ bytes[i]) * 0x100000001b3;
+            }
+            return hash;
+        }
+
+        value_type* elements() const noexcept
+        {
+            return reinterpret_cast<value_type*>(mHeader + 1);
+        }
+        size_type mapped_length() const noexcept
+        {
+            return sizeof(header) + mCapacity * sizeof(value_type);
+        }
+        void require_writable(const char* function) const
+        {
+            if (!writable())
+            {
+                throw std::logic_error(std::string("eng::mapped_vector<Type>::") + function + "() was called on a read-only mapping");
+            }
+        }
+
+        void map()
+        {
+            int protection = writable() ? PROT_READ | PROT_WRITE : PROT_READ;
+            void* mapping = ::mmap(nullptr, mapped_length(), protection, MAP_SHARED, mFile, 0);
+            if (mapping == MAP_FAILED)
+            {
+                int error = errno;
+                close_file();
+                throw std::system_error(error, std::generic_category(), "eng::mapped_vector<Type> failed to map file");
+            }
+            mHeader = static_cast<header*>(mapping);
+        }
+        void unmap() noexcept
+        {
+            if (mHeader)
+            {
+                ::munmap(mHeader, mapped_length());
+                mHeader = nullptr;
+            }
+        }
+        void remap(size_type newCapacity)
+        {
+            size_type oldLength = mapped_length();
+            size_type newLength = sizeof(header) + newCapacity * sizeof(value_type);
+
+            if (::ftruncate(mFile, static_cast<off_t>(newLength)) < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "eng::mapped_vector<Type> failed to resize file");
+            }
+
+#if defined(__linux__)
+            void* mapping = ::mremap(mHeader, oldLength, newLength, MREMAP_MAYMOVE);
+            if (mapping == MAP_FAILED)
+            {
+                throw std::system_error(errno, std::generic_category(), "eng::mapped_vector<Type> failed to remap file");
+            }
+            mHeader = static_cast<header*>(mapping);
+            mCapacity = newCapacity;
+#else
+            ::munmap(mHeader, oldLength);
+            mHeader = nullptr;
+            mCapacity = newCapacity;
+            map();
+#endif
+        }
+        void close_file() noexcept
+        {
+            if (mFile >= 0)
+            {
+                ::close(mFile);
+                mFile = -1;
+            }
+        }
+
+    private:
+        map_mode mMode;
+        int mFile;
+        size_type mCapacity;
+        header* mHeader;
+        bool mDirty;
+    };
+
+}
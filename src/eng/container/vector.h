@@ -5,6 +5,8 @@
 #include <iterator>
 #include <memory>
 
+#include "../memory/aligned_allocator.h"
+
 namespace eng
 {
 
@@ -46,10 +48,10 @@ namespace eng
             mCapacity(other.mCapacity),
             mData(allocator_traits::allocate(mAllocator, mCapacity))
         {
-            std::uninitialized_copy_n(other.mData, mSize, mData);
+            construct_copy_n(other.mData, mSize, mData);
         }
         constexpr vector(const vector& other) :
-            vector(other, allocator_traits::select_on_copy_construction(other.mAllocator))
+            vector(other, allocator_traits::select_on_container_copy_construction(other.mAllocator))
         { }
         constexpr vector(vector&& other, const allocator_type& alloc) noexcept :
             vector(alloc)
@@ -66,7 +68,7 @@ namespace eng
             mCapacity(count),
             mData(allocator_traits::allocate(mAllocator, mCapacity))
         {
-            std::uninitialized_default_construct_n(mData, count);
+            construct_default_n(mData, count);
         }
         constexpr vector(size_type count, const value_type& value, const allocator_type& alloc = allocator_type{ }) :
             mAllocator(alloc),
@@ -74,7 +76,7 @@ namespace eng
             mCapacity(count),
             mData(allocator_traits::allocate(mAllocator, mCapacity))
         {
-            std::uninitialized_fill_n(mData, count, value);
+            construct_fill_n(mData, count, value);
         }
 
         constexpr vector(std::initializer_list<value_type> list, const allocator_type& alloc = { }) :
@@ -119,7 +121,7 @@ namespace eng
             return *this;
         }
 
-        ~vector()
+        constexpr ~vector()
         {
             reset();
         }
@@ -164,7 +166,7 @@ namespace eng
         constexpr void reset()
         {
             clear();
-            allocator_traits::deallocate(mAllocator, mData, mCapacity);
+            deallocate();
             mData = nullptr;
         }
         constexpr void reserve(size_type newCapacity)
@@ -176,12 +178,13 @@ namespace eng
         }
         constexpr void resize(size_type newSize)
         {
-            size_type oldSize = mSize;
             if (mCapacity < newSize)
             {
                 reallocate(newSize);
             }
-            std::uninitialized_default_construct_n(mData, (oldSize < newSize ? newSize - oldSize : 0));
+            construct_default_n(mData + mSize, (mSize < newSize ? newSize - mSize : 0));
+            std::destroy_n(mData + newSize, (newSize < mSize ? mSize - newSize : 0));
+            mSize = newSize;
         }
         constexpr void shrink_to_fit()
         {
@@ -193,56 +196,41 @@ namespace eng
 
         constexpr void assign(size_type count, const value_type& value)
         {
-            value_type* data = mData;
+            // Build in a fresh buffer, then release the old one
             if (count > mCapacity)
             {
-                data = allocator_traits::allocate(mAllocator, count);
+                value_type* data = allocator_traits::allocate(mAllocator, count);
+                construct_fill_n(data, count, value);
+                replace_data(data, count, count);
+                return;
             }
 
             size_t assignRange = std::min(count, mSize);
 
-            std::fill_n(data, assignRange, value);
-            std::destroy_n(data + assignRange, (assignRange < mSize ? mSize - assignRange : 0));
-            std::uninitialized_fill_n(data + mSize, (mSize < count ? count - mSize : 0), value);
-
-            if (count > mCapacity)
-            {
-                allocator_traits::deallocate(mAllocator, mData, mCapacity);
-                mData = data;
-                mCapacity = count;
-            }
+            std::fill_n(mData, assignRange, value);
+            std::destroy_n(mData + assignRange, (assignRange < mSize ? mSize - assignRange : 0));
+            construct_fill_n(mData + assignRange, count - assignRange, value);
             mSize = count;
         }
-        template<typename InputIt>
-        constexpr void assign(InputIt begin, InputIt end)
+        template<std::random_access_iterator RandomIt>  // Constrained so assign(count, value) with integers is not taken as a range
+        constexpr void assign(RandomIt begin, RandomIt end)
         {
-            value_type* data = mData;
             size_type rangeSize = end - begin;
 
+            // Build in a fresh buffer, then release the old one
             if (rangeSize > mCapacity)
             {
-                data = allocator_traits::allocate(mAllocator, rangeSize);
+                value_type* data = allocator_traits::allocate(mAllocator, rangeSize);
+                construct_copy_n(begin, rangeSize, data);
+                replace_data(data, rangeSize, rangeSize);
+                return;
             }
 
-            if constexpr (std::is_trivially_copyable_v<value_type>)
-            {
-                std::memcpy(data, begin, rangeSize);
-            }
-            else
-            {
-                size_t assignRange = std::min(rangeSize, mSize);
-
-                std::copy_n(begin, assignRange, data);
-                std::destroy_n(data + assignRange, (assignRange < mSize ? mSize - assignRange : 0));
-                std::uninitialized_copy_n(begin + assignRange, (assignRange < rangeSize ? rangeSize - assignRange : 0), data + mSize);
-            }
+            size_t assignRange = std::min(rangeSize, mSize);
 
-            if (rangeSize > mCapacity)
-            {
-                allocator_traits::deallocate(mAllocator, mData, mCapacity);
-                mData = data;
-                mCapacity = rangeSize;
-            }
+            std::copy_n(begin, assignRange, mData);
+            std::destroy_n(mData + assignRange, (assignRange < mSize ? mSize - assignRange : 0));
+            construct_copy_n(begin + assignRange, rangeSize - assignRange, mData + assignRange);
             mSize = rangeSize;
         }
         constexpr void assign(std::initializer_list<value_type> list)
@@ -251,7 +239,7 @@ namespace eng
         }
         constexpr void swap(vector& other) noexcept
         {
-            if constexpr (allocator_traits::propogate_on_container_swap::value)
+            if constexpr (allocator_traits::propagate_on_container_swap::value)
             {
                 swap_with_allocator(other);
             }
@@ -393,7 +381,17 @@ namespace eng
             // Relocate data to new buffer; cannot use stdlib algs due to lack of ranged move_if_noexcept and destroy_at
             if constexpr (std::is_trivially_copyable_v<value_type>) // Try to memcpy for trivial types
             {
-                std::memcpy(newData, mData, newSize);
+                if (std::is_constant_evaluated())   // memcpy cannot begin object lifetimes during constant evaluation
+                {
+                    for (size_t i = 0; i < newSize; ++i)
+                    {
+                        std::construct_at(newData + i, mData[i]);
+                    }
+                }
+                else if (newSize)   // mData may be null before first allocation
+                {
+                    std::memcpy(newData, mData, newSize * sizeof(value_type));
+                }
             }
             else
             {
@@ -409,11 +407,65 @@ namespace eng
             std::destroy_n(mData, (newSize < mSize ? mSize - newSize : 0));
 
             // Redirect member variables to new data
-            allocator_traits::deallocate(mAllocator, mData, mCapacity);
+            deallocate();
             mSize = newSize;
             mCapacity = newCapacity;
             mData = newData;
         }
+        constexpr void replace_data(value_type* data, size_type size, size_type capacity)
+        {
+            clear();
+            deallocate();
+            mData = data;
+            mSize = size;
+            mCapacity = capacity;
+        }
+        constexpr void deallocate() noexcept
+        {
+            if (mData)  // Deallocating null is rejected during constant evaluation
+            {
+                allocator_traits::deallocate(mAllocator, mData, mCapacity);
+            }
+        }
+        // Uninitialized-memory algorithms are not constexpr until C++26; construct element-wise during constant evaluation
+        static constexpr void construct_default_n(value_type* first, size_type count)
+        {
+            if (std::is_constant_evaluated())
+            {
+                for (size_type i = 0; i < count; ++i)
+                {
+                    std::construct_at(first + i);
+                }
+                return;
+            }
+            std::uninitialized_default_construct_n(first, count);
+        }
+        static constexpr void construct_fill_n(value_type* first, size_type count, const value_type& value)
+        {
+            if (std::is_constant_evaluated())
+            {
+                for (size_type i = 0; i < count; ++i)
+                {
+                    std::construct_at(first + i, value);
+                }
+                return;
+            }
+            std::uninitialized_fill_n(first, count, value);
+        }
+        template<std::random_access_iterator RandomIt>
+        static constexpr void construct_copy_n(RandomIt source, size_type count, value_type* destination)
+        {
+            if (std::is_constant_evaluated())
+            {
+                for (size_type i = 0; i < count; ++i)
+                {
+                    std::construct_at(destination + i, *(source + i));
+                }
+                return;
+            }
+            std::uninitialized_copy_n(source, count, destination);   // Lowers to memmove for trivially copyable ranges
+        }
+
         constexpr void swap_with_allocator(vector& other) noexcept
         {
             using std::swap;
@@ -435,6 +487,14 @@ namespace eng
         value_type* mData;
     };
 
+    // Cache-line-aligned storage so SIMD loops never straddle the start of the buffer
+    template<typename Type, size_t Alignment = CACHE_LINE_SIZE>
+    using aligned_vector = vector<Type, aligned_allocator<Type, Alignment>>;
+
+    // Huge-page-backed storage for multi-GB arrays whose scans are TLB-bound
+    template<typename Type, size_t Alignment = CACHE_LINE_SIZE>
+    using huge_page_vector = vector<Type, huge_page_allocator<Type, Alignment>>;
+
 }
 
 namespace std
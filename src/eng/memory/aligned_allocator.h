@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace eng
+{
+
+    inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Allocates storage aligned to at least Alignment bytes; defaults to a full cache line to avoid split SIMD loads
+    template<typename Type, size_t Alignment = CACHE_LINE_SIZE>
+    struct aligned_allocator
+    {
+        static_assert(Alignment && !(Alignment & (Alignment - 1)), "eng::aligned_allocator<Type, Alignment> requires a power of two alignment");
+
+        using value_type = Type;
+        using size_type = size_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        static constexpr size_t alignment = Alignment < alignof(Type) ? alignof(Type) : Alignment;
+
+        template<typename Other>
+        struct rebind
+        {
+            using other = aligned_allocator<Other, Alignment>;
+        };
+
+        constexpr aligned_allocator() noexcept = default;
+        template<typename Other>
+        constexpr aligned_allocator(const aligned_allocator<Other, Alignment>&) noexcept
+        { }
+
+        [[nodiscard]] Type* allocate(size_type count)
+        {
+            if (count > std::numeric_limits<size_type>::max() / sizeof(Type))
+            {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<Type*>(::operator new(count * sizeof(Type), std::align_val_t{ alignment }));
+        }
+        void deallocate(Type* data, size_type) noexcept
+        {
+            ::operator delete(data, std::align_val_t{ alignment });   // Null-safe, matches reset() on empty vectors
+        }
+
+        template<typename Other>
+        constexpr bool operator==(const aligned_allocator<Other, Alignment>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    // Backs large buffers with huge pages to cut TLB misses on multi-GB scans; small buffers use aligned_allocator
+    // Tries explicit huge pages (MAP_HUGETLB) first, then falls back to transparent huge pages (MADV_HUGEPAGE),
+    // then to plain pages. Non-Linux targets always use aligned_allocator.
+    template<typename Type, size_t Alignment = CACHE_LINE_SIZE>
+    struct huge_page_allocator
+    {
+        static_assert(Alignment <= 4096, "eng::huge_page_allocator<Type, Alignment> mappings only guarantee base page alignment");
+
+        using value_type = Type;
+        using size_type = size_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        static constexpr size_t HUGE_PAGE_SIZE = size_t{ 2 } << 20;    // 2MiB; requested explicitly since the system default may differ
+
+        template<typename Other>
+        struct rebind
+        {
+            using other = huge_page_allocator<Other, Alignment>;
+        };
+
+        constexpr huge_page_allocator() noexcept = default;
+        template<typename Other>
+        constexpr huge_page_allocator(const huge_page_allocator<Other, Alignment>&) noexcept
+        { }
+
+        [[nodiscard]] Type* allocate(size_type count)
+        {
+            if (!uses_huge_pages(count))
+            {
+                return mFallback.allocate(count);
+            }
+            if (count > (std::numeric_limits<size_type>::max() - HUGE_PAGE_SIZE) / sizeof(Type))
+            {
+                throw std::bad_array_new_length();
+            }
+
+#if defined(__linux__)
+            size_type length = mapped_length(count);
+            void* data = MAP_FAILED;
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+            // Explicit huge pages only succeed if the administrator has reserved a 2MiB pool
+            // Page size is pinned to HUGE_PAGE_SIZE (log2 = 21) so mapped_length() stays a valid munmap length
+            data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1, 0);
+#endif
+            if (data == MAP_FAILED)
+            {
+                data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (data == MAP_FAILED)
+                {
+                    throw std::bad_alloc();
+                }
+
+#if defined(MADV_HUGEPAGE)
+                madvise(data, length, MADV_HUGEPAGE);   // Advisory only; failure leaves regular pages
+#endif
+            }
+            return static_cast<Type*>(data);
+#else
+            return mFallback.allocate(count);
+#endif
+        }
+        void deallocate(Type* data, size_type count) noexcept
+        {
+            if (!data)
+            {
+                return;
+            }
+
+#if defined(__linux__)
+            if (uses_huge_pages(count))
+            {
+                munmap(data, mapped_length(count));
+                return;
+            }
+#endif
+            mFallback.deallocate(data, count);
+        }
+
+        template<typename Other>
+        constexpr bool operator==(const huge_page_allocator<Other, Alignment>&) const noexcept
+        {
+            return true;
+        }
+
+    private:
+        // Allocation path is chosen by size alone so deallocate can recover it without bookkeeping
+        static constexpr bool uses_huge_pages(size_type count) noexcept
+        {
+            return count >= HUGE_PAGE_SIZE / sizeof(Type);
+        }
+        static constexpr size_type mapped_length(size_type count) noexcept
+        {
+            return (count * sizeof(Type) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);    // MAP_HUGETLB requires whole pages
+        }
+
+        [[no_unique_address]] aligned_allocator<Type, Alignment> mFallback;
+    };
+
+}
@@ -2,12 +2,64 @@
 #include <random>
 #include <vector>
 
+#include "eng/algorithm/argsort.h"
+#include "eng/algorithm/partial_sort.h"
+#include "eng/algorithm/sort_unique.h"
+#include "eng/algorithm/sorted_append.h"
+#include "eng/algorithm/sorting_network.h"
 #include "eng/algorithm/stable_sort.h"
 #include "eng/container/vector.h"
 
 #include "tracker.h"
 #include "timer.h"
 
+// Compile-time checks that every eng algorithm is usable in constant evaluation
+static_assert([] {
+    eng::vector<int> table = { 5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0, 11 };
+    eng::stable_sort(table.begin(), table.end());
+    return table[0] == 0 && table[1] == 1 && table[11] == 11;
+}());
+static_assert([] {
+    eng::vector<int> table = { 5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0, 11 };
+    eng::stable_partial_sort(table.begin(), table.begin() + 3, table.end());
+    return table[0] == 0 && table[1] == 1 && table[2] == 2;
+}());
+static_assert([] {
+    eng::vector<int> table = { 5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0, 11 };
+    eng::stable_nth_element(table.begin(), table.begin() + 4, table.end());
+    return table[4] == 3;
+}());
+static_assert([] {
+    eng::vector<int> table = { 30, 10, 20 };
+    eng::vector<size_t> permutation = eng::stable_argsort(table.begin(), table.end());
+    eng::apply_permutation(table.begin(), table.end(), permutation.begin());
+    return permutation[0] == 1 && table[0] == 10 && table[2] == 30;
+}());
+static_assert([] {
+    int keys[] = { 3, 1, 2 };
+    int values[] = { 30, 10, 20 };
+    eng::stable_sort_parallel(keys, keys + 3, values);
+    return keys[0] == 1 && values[0] == 10 && values[2] == 30;
+}());
+static_assert([] {
+    eng::vector<int> table = { 1, 4, 7 };
+    int batch[] = { 5, 2 };
+    eng::sorted_append(table, batch, batch + 2);
+    return table.size() == 5 && table[1] == 2 && table[3] == 5;
+}());
+static_assert([] {
+    int tuple[] = { 9, 3, 12, 1, 5, 0, 7, 11, 2, 10, 4, 8, 6 };
+    eng::sort_n<13>(tuple);
+    return tuple[0] == 0 && tuple[6] == 6 && tuple[12] == 12;
+}());
+static_assert([] {
+    eng::vector<int> table = { 3, 1, 3, 2, 1 };
+    eng::stable_sort_unique(table);
+    eng::vector<int> counts = { 2, 2, 1 };
+    eng::stable_sort_unique(counts, [](int kept, int duplicate) { return kept + duplicate; });
+    return table.size() == 3 && table[2] == 3 && counts.size() == 2 && counts[1] == 4;
+}());
+
 int main()
 {
     constexpr int size = 1000;